@@ -0,0 +1,211 @@
+/*******************************************************************************************
+*
+*   Audio mixer stress benchmark (null audio device, no window or sound card required)
+*
+*   Loads generated sounds and aliases of them, then simulates program frames issuing many audio
+*   commands per frame (play, stop, volume, pitch, pan and playing state checks) while the audio
+*   thread mixes them on miniaudio null device, and prints one CSV line per run:
+*
+*       simd, sounds, commands_per_frame, command_ns, frame_max_us, mix_load, realtime
+*
+*   command_ns is the average program thread time per audio command.
+*   frame_max_us is the worst program thread time issuing the commands of a frame (stalls).
+*   mix_load is the process CPU time spent out of program frames over elapsed time, it is
+*   the audio thread load (CPU time is measured with clock(), wall time on Windows).
+*   realtime is the number of frames mixed over the number of frames expected in elapsed time,
+*   lower than 1.0 means the audio thread does not keep up (dropouts on a real device).
+*
+*   Usage: audio_mixer [sounds] [frames per second] [seconds per run]
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#if defined(_WIN32)
+    __declspec(dllimport) void __stdcall Sleep(unsigned long msTimeout);
+#endif
+
+#define BASE_SOUNDS     8       // Generated sounds, the rest are aliases of them
+
+static unsigned int seed = 0x12345678;
+static unsigned long long framesMixed = 0;
+
+static unsigned int Random(void)
+{
+    seed = seed*1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+static float RandomFloat(void)
+{
+    return (float)Random()/16777216.0f;
+}
+
+static double GetSeconds(void)
+{
+    struct timespec ts = { 0 };
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+static void SleepSeconds(double seconds)
+{
+#if defined(_WIN32)
+    Sleep((unsigned long)(seconds*1000.0));
+#else
+    struct timespec req = { (time_t)seconds, (long)((seconds - (time_t)seconds)*1e9) };
+    while (nanosleep(&req, &req) == -1) continue;
+#endif
+}
+
+// Mixed audio processor, counts frames sent to the device
+static void CountFramesMixed(void *buffer, unsigned int frames)
+{
+    (void)buffer;
+    framesMixed += frames;
+}
+
+// Generate sound wave, decaying tone with some noise, 16 bit mono
+static RL_Wave GenWaveSound(int index)
+{
+    RL_Wave wave = { 0 };
+
+    wave.sampleRate = 44100;
+    wave.sampleSize = 16;
+    wave.channels = 1;
+    wave.frameCount = wave.sampleRate/8 + (unsigned int)index*wave.sampleRate/8;     // 0.125 to 1 seconds
+    wave.data = RL_MemAlloc(wave.frameCount*sizeof(short));
+
+    short *samples = (short *)wave.data;
+    float frequency = 220.0f*(1.0f + (float)index*0.25f);
+
+    for (unsigned int i = 0; i < wave.frameCount; i++)
+    {
+        float t = (float)i/(float)wave.sampleRate;
+        float value = sinf(2.0f*PI*frequency*t)*expf(-3.0f*t) + (RandomFloat() - 0.5f)*0.1f;
+        samples[i] = (short)(value*16000.0f);
+    }
+
+    return wave;
+}
+
+// Issue one random audio command on a random sound
+static void RunCommand(RL_Sound *sounds, int soundCount)
+{
+    RL_Sound sound = sounds[Random()%soundCount];
+    unsigned int op = Random()%20;
+
+    if (op < 8) RL_PlaySound(sound);
+    else if (op < 10) RL_StopSound(sound);
+    else if (op < 13) RL_SetSoundVolume(sound, 0.2f + RandomFloat()*0.8f);
+    else if (op < 16) RL_SetSoundPitch(sound, 0.5f + RandomFloat()*1.5f);
+    else if (op < 19) RL_SetSoundPan(sound, RandomFloat());
+    else if (RL_IsSoundPlaying(sound)) RL_SetSoundVolume(sound, 0.5f);
+}
+
+int main(int argc, char *argv[])
+{
+    int soundCount = (argc > 1)? atoi(argv[1]) : 256;
+    int framesPerSecond = (argc > 2)? atoi(argv[2]) : 240;
+    double runSeconds = (argc > 3)? atof(argv[3]) : 2.0;
+
+    if (soundCount < BASE_SOUNDS) soundCount = BASE_SOUNDS;
+    if (framesPerSecond < 1) framesPerSecond = 1;
+
+    RL_SetTraceLogLevel(LOG_ERROR);
+
+    RL_InitAudioDeviceNull();
+
+    if (!RL_IsAudioDeviceReady())
+    {
+        printf("Null audio device could not be initialized\n");
+        return 1;
+    }
+
+    RL_Sound *sounds = (RL_Sound *)RL_MemAlloc(soundCount*sizeof(RL_Sound));
+
+    for (int i = 0; i < BASE_SOUNDS; i++)
+    {
+        RL_Wave wave = GenWaveSound(i);
+        sounds[i] = RL_LoadSoundFromWave(wave);
+        RL_UnloadWave(wave);
+    }
+
+    for (int i = BASE_SOUNDS; i < soundCount; i++) sounds[i] = RL_LoadSoundAlias(sounds[i%BASE_SOUNDS]);
+
+    const int commandCounts[] = { 16, 128, 1024, 4096 };
+    const double sampleRate = (double)sounds[0].stream.sampleRate;
+    const double framePeriod = 1.0/framesPerSecond;
+
+    RL_SetSimdLevel(SIMD_LEVEL_AVX2);
+    int maxSimdLevel = RL_GetSimdLevel();
+
+    printf("simd, sounds, commands_per_frame, command_ns, frame_max_us, mix_load, realtime\n");
+
+    for (int simd = SIMD_LEVEL_NONE; simd <= maxSimdLevel; simd++)
+    {
+        RL_SetSimdLevel(simd);
+
+        for (int c = 0; c < (int)(sizeof(commandCounts)/sizeof(commandCounts[0])); c++)
+        {
+            int commandsPerFrame = commandCounts[c];
+
+            framesMixed = 0;
+            RL_AttachAudioMixedProcessor(CountFramesMixed);
+
+            double commandSeconds = 0.0;
+            double frameMaxSeconds = 0.0;
+            double commands = 0.0;
+            clock_t cpuStart = clock();
+            double start = GetSeconds();
+            double elapsed = 0.0;
+            int frame = 0;
+
+            while (elapsed < runSeconds)
+            {
+                double frameStart = GetSeconds();
+
+                for (int i = 0; i < commandsPerFrame; i++) RunCommand(sounds, soundCount);
+
+                double frameSeconds = GetSeconds() - frameStart;
+                commandSeconds += frameSeconds;
+                commands += commandsPerFrame;
+                if (frameSeconds > frameMaxSeconds) frameMaxSeconds = frameSeconds;
+
+                // Wait for next frame, program thread leaves the CPU to the audio thread
+                frame++;
+                double wait = start + frame*framePeriod - GetSeconds();
+                if (wait > 0.0) SleepSeconds(wait);
+
+                elapsed = GetSeconds() - start;
+            }
+
+            double cpuSeconds = (double)(clock() - cpuStart)/CLOCKS_PER_SEC;
+
+            // NOTE: Detaching the processor locks the audio thread out, frames count can be read
+            RL_DetachAudioMixedProcessor(CountFramesMixed);
+
+            double mixLoad = (cpuSeconds - commandSeconds)/elapsed;
+            if (mixLoad < 0.0) mixLoad = 0.0;
+
+            printf("%d, %d, %d, %.1f, %.1f, %.4f, %.4f\n", simd, soundCount, commandsPerFrame, commandSeconds/commands*1e9,
+                frameMaxSeconds*1e6, mixLoad, (double)framesMixed/(elapsed*sampleRate));
+            fflush(stdout);
+
+            for (int i = 0; i < soundCount; i++) RL_StopSound(sounds[i]);
+        }
+    }
+
+    for (int i = BASE_SOUNDS; i < soundCount; i++) RL_UnloadSoundAlias(sounds[i]);
+    for (int i = 0; i < BASE_SOUNDS; i++) RL_UnloadSound(sounds[i]);
+    RL_MemFree(sounds);
+
+    RL_CloseAudioDevice();
+
+    return 0;
+}
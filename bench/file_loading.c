@@ -0,0 +1,277 @@
+/*******************************************************************************************
+*
+*   File loading benchmark (no window required)
+*
+*   Generates a tree of asset files (mostly small ones, some big ones, half of them compressible),
+*   exports them to pack files, then loads every asset, touching all its bytes, and prints one
+*   CSV line per run:
+*
+*       mode, cache, files, mbytes, ms, files_per_s, mb_per_s, exact
+*
+*   Modes:
+*       stdio: fopen(), fread() into an allocated buffer, fclose() (RL_LoadFileData() without mapping)
+*       loose: RL_LoadFileData(), small files read with native file functions, big files mapped
+*       pack: RL_LoadPackFileData() from a mounted pack file, entries aligned, not compressed (copied)
+*       pack_shared: RL_LoadPackFileDataShared() from the same pack file (not copied)
+*       pack_lz4: RL_LoadPackFileData() from a mounted pack file, entries compressed (LZ4)
+*
+*   Cold runs drop assets and packs from the OS file cache first (Linux only, skipped elsewhere),
+*   warm runs load them again right after. Pack runs include RL_MountPack() and RL_UnmountPack().
+*   exact tells if every asset data matches the generated one.
+*
+*   Usage: file_loading [files] [runs per mode]
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_WIN32)
+    #include <direct.h>             // Required for: _mkdir()
+    #define MKDIR(dir) _mkdir(dir)
+#else
+    #include <sys/stat.h>           // Required for: mkdir()
+    #define MKDIR(dir) mkdir(dir, 0777)
+#endif
+
+#if defined(__linux__)
+    #include <fcntl.h>              // Required for: open(), posix_fadvise()
+    #include <unistd.h>             // Required for: close()
+#endif
+
+#define ASSETS_DIRECTORY    "file_loading_assets"
+#define ASSETS_FOLDERS      16          // Assets are spread on this number of folders
+
+typedef enum {
+    MODE_STDIO = 0,
+    MODE_LOOSE,
+    MODE_PACK,
+    MODE_PACK_SHARED,
+    MODE_PACK_LZ4
+} BenchMode;
+
+static const char *modeNames[] = { "stdio", "loose", "pack", "pack_shared", "pack_lz4" };
+static const char *packNames[] = { NULL, NULL, "file_loading.rpak", "file_loading.rpak", "file_loading_lz4.rpak" };
+
+static unsigned int seed = 0x12345678;
+
+static unsigned int Random(void)
+{
+    seed = seed*1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+static double GetSeconds(void)
+{
+    struct timespec ts = { 0 };
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+// Drop file from OS file cache, returns false if not supported
+static bool EvictFile(const char *fileName)
+{
+#if defined(__linux__)
+    int file = open(fileName, O_RDONLY);
+    if (file == -1) return false;
+
+    int result = posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+    close(file);
+
+    return (result == 0);
+#else
+    (void)fileName;
+    return false;
+#endif
+}
+
+// Get asset data checksum, reads every byte, 8 bytes at a time
+static unsigned long long GetChecksum(const unsigned char *data, int dataSize)
+{
+    unsigned long long checksum = 0;
+    int i = 0;
+
+    for (; i <= (dataSize - 8); i += 8)
+    {
+        unsigned long long value = 0;
+        memcpy(&value, data + i, 8);
+        checksum = checksum*31 + value;
+    }
+
+    for (; i < dataSize; i++) checksum = checksum*31 + data[i];
+
+    return checksum;
+}
+
+// Generate asset data: 70% small files (1-32 KB), 25% medium files (32-256 KB), 5% big files (256 KB-4 MB),
+// odd assets are compressible (repeated text with some noise)
+static unsigned char *GenAssetData(int index, int *dataSize)
+{
+    unsigned int kind = Random()%100;
+    int size = (kind < 70)? 1024 + (int)(Random()%(31*1024)) :
+        (kind < 95)? 32*1024 + (int)(Random()%(224*1024)) : 256*1024 + (int)(Random()%(3840*1024));
+
+    unsigned char *data = (unsigned char *)RL_MemAlloc(size);
+
+    if (index%2 == 0) for (int i = 0; i < size; i++) data[i] = (unsigned char)Random();
+    else
+    {
+        const char *text = "vertex position normal texcoord material diffuse specular ";
+        int textLength = (int)strlen(text);
+
+        for (int i = 0; i < size; i++) data[i] = (Random()%16 == 0)? (unsigned char)Random() : (unsigned char)text[(i + index)%textLength];
+    }
+
+    *dataSize = size;
+
+    return data;
+}
+
+// Load file data with standard file functions, as RL_LoadFileData() does without mapped files
+static unsigned char *LoadFileStdio(const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        int size = (int)ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            data = (unsigned char *)RL_MemAlloc(size);
+            *dataSize = (int)fread(data, 1, size, file);
+        }
+
+        fclose(file);
+    }
+
+    return data;
+}
+
+int main(int argc, char *argv[])
+{
+    int fileCount = (argc > 1)? atoi(argv[1]) : 2000;
+    int runCount = (argc > 2)? atoi(argv[2]) : 3;
+
+    if (fileCount < 1) fileCount = 1;
+    if (runCount < 1) runCount = 1;
+
+    RL_SetTraceLogLevel(LOG_ERROR);
+
+    // Generate assets
+    //--------------------------------------------------------------------------------------
+    char **paths = (char **)RL_MemAlloc(fileCount*sizeof(char *));
+    unsigned long long *checksums = (unsigned long long *)RL_MemAlloc(fileCount*sizeof(unsigned long long));
+    double totalBytes = 0.0;
+
+    MKDIR(ASSETS_DIRECTORY);
+
+    for (int i = 0; i < ASSETS_FOLDERS; i++) MKDIR(RL_TextFormat("%s/folder%02i", ASSETS_DIRECTORY, i));
+
+    for (int i = 0; i < fileCount; i++)
+    {
+        int dataSize = 0;
+        unsigned char *data = GenAssetData(i, &dataSize);
+
+        paths[i] = (char *)RL_MemAlloc(64);
+        snprintf(paths[i], 64, "%s/folder%02i/asset%05i.bin", ASSETS_DIRECTORY, i%ASSETS_FOLDERS, i);
+
+        RL_SaveFileData(paths[i], data, dataSize);
+        checksums[i] = GetChecksum(data, dataSize);
+        totalBytes += dataSize;
+
+        RL_MemFree(data);
+    }
+
+    RL_FilePathList files = { 0 };
+    files.count = fileCount;
+    files.paths = paths;
+
+    RL_ExportPack(files, ASSETS_DIRECTORY, packNames[MODE_PACK], 16, false);
+    RL_ExportPack(files, ASSETS_DIRECTORY, packNames[MODE_PACK_LZ4], 16, true);
+
+    // Load assets
+    //--------------------------------------------------------------------------------------
+    printf("mode, cache, files, mbytes, ms, files_per_s, mb_per_s, exact\n");
+
+    for (int mode = MODE_STDIO; mode <= MODE_PACK_LZ4; mode++)
+    {
+        for (int cache = 0; cache < 2; cache++)
+        {
+            double seconds = 0.0;
+            bool exact = true;
+            bool cold = (cache == 0);
+
+            // NOTE: Warm runs follow cold runs, files are on OS file cache already
+            int runs = 0;
+
+            for (int run = 0; run < runCount; run++)
+            {
+                if (cold)
+                {
+                    bool evicted = true;
+                    for (int i = 0; i < fileCount; i++) evicted &= EvictFile(paths[i]);
+                    if (packNames[mode] != NULL) evicted &= EvictFile(packNames[mode]);
+                    if (!evicted) break;
+                }
+
+                double start = GetSeconds();
+
+                if (packNames[mode] != NULL) RL_MountPack(packNames[mode], ASSETS_DIRECTORY);
+
+                for (int i = 0; i < fileCount; i++)
+                {
+                    int dataSize = 0;
+                    unsigned char *data = NULL;
+
+                    if (mode == MODE_STDIO) data = LoadFileStdio(paths[i], &dataSize);
+                    else if (mode == MODE_LOOSE) data = RL_LoadFileData(paths[i], &dataSize);
+                    else if (mode == MODE_PACK_SHARED) data = (unsigned char *)RL_LoadPackFileDataShared(paths[i], &dataSize);
+                    else data = RL_LoadPackFileData(paths[i], &dataSize);
+
+                    if ((data == NULL) || (GetChecksum(data, dataSize) != checksums[i])) exact = false;
+
+                    if (mode == MODE_STDIO) RL_MemFree(data);
+                    else if (mode == MODE_PACK_SHARED) RL_UnloadPackFileDataShared(data);
+                    else RL_UnloadFileData(data);
+                }
+
+                if (packNames[mode] != NULL) RL_UnmountPack(packNames[mode]);
+
+                seconds += GetSeconds() - start;
+                runs++;
+            }
+
+            if (runs == 0) continue;
+
+            seconds /= runs;
+
+            printf("%s, %s, %d, %.2f, %.2f, %.1f, %.1f, %d\n", modeNames[mode], cold? "cold" : "warm", fileCount, totalBytes/1e6,
+                seconds*1e3, fileCount/seconds, totalBytes/1e6/seconds, exact? 1 : 0);
+            fflush(stdout);
+        }
+    }
+
+    for (int i = 0; i < fileCount; i++)
+    {
+        remove(paths[i]);
+        RL_MemFree(paths[i]);
+    }
+
+    remove(packNames[MODE_PACK]);
+    remove(packNames[MODE_PACK_LZ4]);
+
+    RL_MemFree(checksums);
+    RL_MemFree(paths);
+
+    return 0;
+}
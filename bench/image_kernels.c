@@ -0,0 +1,236 @@
+/*******************************************************************************************
+*
+*   Image processing kernels benchmark (CPU only, no window required)
+*
+*   Runs RL_LoadImageColors() conversions, RL_ImageResize(), RL_ImageResizeNN(), RL_ImageDraw(),
+*   RL_ImageAlphaPremultiply() and RL_ImageBlurGaussian() for every available SIMD level,
+*   on the calling thread only and on the worker pool, and prints one CSV line per run:
+*
+*       op, simd, threads, width, height, mpix_per_s, exact
+*
+*   Megapixels are counted on the processed image (the output one for resize).
+*   exact tells if the result matches the scalar single-threaded one byte per byte.
+*
+*   Usage: image_kernels [width] [height] [seconds per run]
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef enum {
+    OP_LOAD_COLORS = 0,
+    OP_RESIZE,
+    OP_RESIZE_NN,
+    OP_DRAW,
+    OP_ALPHA_PREMULTIPLY,
+    OP_BLUR
+} BenchOp;
+
+typedef struct {
+    const char *name;
+    BenchOp op;
+    int format;         // Source image pixel format
+} BenchCase;
+
+static const BenchCase cases[] = {
+    { "load_colors_gray", OP_LOAD_COLORS, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE },
+    { "load_colors_gray_alpha", OP_LOAD_COLORS, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA },
+    { "load_colors_r5g6b5", OP_LOAD_COLORS, PIXELFORMAT_UNCOMPRESSED_R5G6B5 },
+    { "load_colors_r8g8b8", OP_LOAD_COLORS, PIXELFORMAT_UNCOMPRESSED_R8G8B8 },
+    { "load_colors_r4g4b4a4", OP_LOAD_COLORS, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4 },
+    { "load_colors_r32g32b32a32", OP_LOAD_COLORS, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 },
+    { "resize_rgba", OP_RESIZE, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 },
+    { "resize_rgb", OP_RESIZE, PIXELFORMAT_UNCOMPRESSED_R8G8B8 },
+    { "resize_nn_rgba", OP_RESIZE_NN, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 },
+    { "draw_rgba_blend", OP_DRAW, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 },
+    { "draw_rgb_opaque", OP_DRAW, PIXELFORMAT_UNCOMPRESSED_R8G8B8 },
+    { "alpha_premultiply", OP_ALPHA_PREMULTIPLY, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 },
+    { "blur_gaussian", OP_BLUR, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 },
+};
+
+static unsigned int seed = 0x12345678;
+
+static unsigned int Random(void)
+{
+    seed = seed*1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+static double GetSeconds(void)
+{
+    struct timespec ts = { 0 };
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+// Generate source image, RGBA images get runs of opaque, transparent and translucent pixels
+static RL_Image GenImageSource(int width, int height, int format)
+{
+    RL_Image image = { 0 };
+    image.width = width;
+    image.height = height;
+    image.mipmaps = 1;
+    image.format = format;
+
+    int size = RL_GetPixelDataSize(width, height, format);
+    image.data = RL_MemAlloc(size);
+
+    if (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)
+    {
+        float *values = (float *)image.data;
+        for (int i = 0; i < size/4; i++) values[i] = (float)(Random()%1000)/999.0f;
+    }
+    else
+    {
+        unsigned char *bytes = (unsigned char *)image.data;
+        for (int i = 0; i < size; i++) bytes[i] = (unsigned char)Random();
+
+        if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+        {
+            for (int i = 0; i < width*height; i++)
+            {
+                int run = (i/61)%3;
+                if (run == 0) bytes[i*4 + 3] = 255;
+                else if (run == 1) bytes[i*4 + 3] = 0;
+            }
+        }
+    }
+
+    return image;
+}
+
+// Run operation once, returns result image (or colors as an image) and number of processed pixels
+static RL_Image RunOp(const BenchCase *bench, RL_Image source, RL_Image target, int *pixels)
+{
+    RL_Image result = { 0 };
+
+    switch (bench->op)
+    {
+        case OP_LOAD_COLORS:
+        {
+            result.data = RL_LoadImageColors(source);
+            result.width = source.width;
+            result.height = source.height;
+            result.mipmaps = 1;
+            result.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            *pixels = source.width*source.height;
+        } break;
+        case OP_RESIZE:
+        {
+            result = RL_ImageCopy(source);
+            RL_ImageResize(&result, source.width*3/4, source.height*3/4);
+            *pixels = result.width*result.height;
+        } break;
+        case OP_RESIZE_NN:
+        {
+            result = RL_ImageCopy(source);
+            RL_ImageResizeNN(&result, source.width*3/2, source.height*3/2);
+            *pixels = result.width*result.height;
+        } break;
+        case OP_DRAW:
+        {
+            result = RL_ImageCopy(target);
+            RL_ImageDraw(&result, source, (RL_Rectangle){ 0, 0, (float)source.width, (float)source.height },
+                (RL_Rectangle){ 0, 0, (float)source.width, (float)source.height }, RL_WHITE);
+            *pixels = source.width*source.height;
+        } break;
+        case OP_ALPHA_PREMULTIPLY:
+        {
+            result = RL_ImageCopy(source);
+            RL_ImageAlphaPremultiply(&result);
+            *pixels = source.width*source.height;
+        } break;
+        case OP_BLUR:
+        {
+            result = RL_ImageCopy(source);
+            RL_ImageBlurGaussian(&result, 4);
+            *pixels = source.width*source.height;
+        } break;
+        default: break;
+    }
+
+    return result;
+}
+
+static bool IsImageEqual(RL_Image a, RL_Image b)
+{
+    if ((a.width != b.width) || (a.height != b.height) || (a.format != b.format)) return false;
+
+    return (memcmp(a.data, b.data, RL_GetPixelDataSize(a.width, a.height, a.format)) == 0);
+}
+
+int main(int argc, char *argv[])
+{
+    int width = (argc > 1)? atoi(argv[1]) : 2048;
+    int height = (argc > 2)? atoi(argv[2]) : 2048;
+    double runSeconds = (argc > 3)? atof(argv[3]) : 0.5;
+
+    RL_SetTraceLogLevel(LOG_ERROR);
+
+    RL_SetSimdLevel(SIMD_LEVEL_AVX2);
+    int maxSimdLevel = RL_GetSimdLevel();
+    RL_SetWorkerThreadCount(0);
+    int maxThreads = RL_GetWorkerThreadCount();
+
+    printf("op, simd, threads, width, height, mpix_per_s, exact\n");
+
+    for (int c = 0; c < (int)(sizeof(cases)/sizeof(cases[0])); c++)
+    {
+        const BenchCase *bench = &cases[c];
+
+        RL_Image source = GenImageSource(width, height, bench->format);
+        RL_Image target = GenImageSource(width, height, bench->format);
+        RL_Image reference = { 0 };
+        int pixels = 0;
+
+        // Scalar single-threaded result is the reference
+        RL_SetSimdLevel(SIMD_LEVEL_NONE);
+        RL_SetWorkerThreadCount(1);
+        reference = RunOp(bench, source, target, &pixels);
+
+        for (int simd = SIMD_LEVEL_NONE; simd <= maxSimdLevel; simd++)
+        {
+            for (int t = 0; t < ((maxThreads > 1)? 2 : 1); t++)
+            {
+                int threads = (t == 0)? 1 : maxThreads;
+
+                RL_SetSimdLevel(simd);
+                RL_SetWorkerThreadCount(threads);
+
+                // Warm up (and start worker threads), then check result
+                RL_Image result = RunOp(bench, source, target, &pixels);
+                bool exact = IsImageEqual(result, reference);
+                RL_UnloadImage(result);
+
+                double totalPixels = 0.0;
+                double start = GetSeconds();
+                double elapsed = 0.0;
+
+                while (elapsed < runSeconds)
+                {
+                    result = RunOp(bench, source, target, &pixels);
+                    RL_UnloadImage(result);
+                    totalPixels += pixels;
+                    elapsed = GetSeconds() - start;
+                }
+
+                printf("%s, %d, %d, %d, %d, %.2f, %d\n", bench->name, simd, threads, width, height,
+                    totalPixels/elapsed*1e-6, exact? 1 : 0);
+                fflush(stdout);
+            }
+        }
+
+        RL_UnloadImage(reference);
+        RL_UnloadImage(target);
+        RL_UnloadImage(source);
+    }
+
+    RL_SetWorkerThreadCount(1);     // Stops worker threads
+
+    return 0;
+}
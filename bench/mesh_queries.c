@@ -0,0 +1,239 @@
+/*******************************************************************************************
+*
+*   Mesh collision queries benchmark (CPU only, no window required)
+*
+*   Builds a terrain mesh, then runs RL_GetRayCollisionMesh(), RL_CheckCollisionMeshBox() and
+*   RL_CheckCollisionMeshSphere() against it with and without mesh BVH, and prints one CSV line per run:
+*
+*       op, accel, triangles, ops_per_s, exact
+*
+*   Ops:
+*       build: RL_GenMeshBVH() from scratch
+*       refit: RL_GenMeshBVH() after moving mesh vertices
+*       ray, box, sphere: mesh queries, picking rays from above and line-of-sight rays along the terrain
+*
+*   exact tells if every query result matches the brute force one (bvh runs only).
+*
+*   Usage: mesh_queries [grid size (max 255)] [queries per run] [seconds per run]
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+static unsigned int seed = 0x12345678;
+
+static float RandomFloat(void)
+{
+    seed = seed*1664525u + 1013904223u;
+    return (float)(seed >> 8)/16777216.0f;
+}
+
+static double GetSeconds(void)
+{
+    struct timespec ts = { 0 };
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+// Generate terrain mesh, indexed grid of size*size vertices in [0..size] xz range, CPU data only
+static RL_Mesh GenTerrain(int size)
+{
+    RL_Mesh mesh = { 0 };
+
+    mesh.vertexCount = size*size;
+    mesh.triangleCount = (size - 1)*(size - 1)*2;
+    mesh.vertices = (float *)RL_MemAlloc(mesh.vertexCount*3*sizeof(float));
+    mesh.indices = (unsigned short *)RL_MemAlloc(mesh.triangleCount*3*sizeof(unsigned short));
+
+    for (int z = 0; z < size; z++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            float *v = &mesh.vertices[(z*size + x)*3];
+            v[0] = (float)x;
+            v[1] = 8.0f*sinf((float)x*0.05f)*cosf((float)z*0.07f) + 2.0f*sinf((float)(x + z)*0.3f) + RandomFloat()*0.5f;
+            v[2] = (float)z;
+        }
+    }
+
+    int k = 0;
+    for (int z = 0; z < (size - 1); z++)
+    {
+        for (int x = 0; x < (size - 1); x++)
+        {
+            unsigned short i = (unsigned short)(z*size + x);
+
+            mesh.indices[k++] = i;
+            mesh.indices[k++] = (unsigned short)(i + size);
+            mesh.indices[k++] = (unsigned short)(i + 1);
+            mesh.indices[k++] = (unsigned short)(i + 1);
+            mesh.indices[k++] = (unsigned short)(i + size);
+            mesh.indices[k++] = (unsigned short)(i + size + 1);
+        }
+    }
+
+    return mesh;
+}
+
+// Random point over the terrain (world space), transform maps [0..size] terrain to world
+static RL_Vector3 GenPoint(int size, float height, RL_Matrix transform)
+{
+    RL_Vector3 point = { RandomFloat()*(float)size, height, RandomFloat()*(float)size };
+
+    return Vector3Transform(point, transform);
+}
+
+static bool IsCollisionEqual(RL_RayCollision a, RL_RayCollision b)
+{
+    if (a.hit != b.hit) return false;
+    if (!a.hit) return true;
+
+    return ((a.distance == b.distance) && (memcmp(&a.point, &b.point, sizeof(RL_Vector3)) == 0) &&
+        (memcmp(&a.normal, &b.normal, sizeof(RL_Vector3)) == 0));
+}
+
+int main(int argc, char *argv[])
+{
+    int size = (argc > 1)? atoi(argv[1]) : 255;
+    int queryCount = (argc > 2)? atoi(argv[2]) : 1000;
+    double runSeconds = (argc > 3)? atof(argv[3]) : 0.5;
+
+    if (size > 255) size = 255;     // 16 bit indices
+    if (size < 2) size = 2;
+
+    RL_SetTraceLogLevel(LOG_ERROR);
+
+    RL_Mesh mesh = GenTerrain(size);
+    RL_Matrix transform = MatrixMultiply(MatrixMultiply(MatrixScale(0.5f, 2.0f, 0.5f),
+        MatrixRotate((RL_Vector3){ 0.2f, 1.0f, 0.1f }, 0.7f)), MatrixTranslate(-30.0f, 5.0f, 12.0f));
+
+    RL_Ray *rays = (RL_Ray *)RL_MemAlloc(queryCount*sizeof(RL_Ray));
+    RL_BoundingBox *boxes = (RL_BoundingBox *)RL_MemAlloc(queryCount*sizeof(RL_BoundingBox));
+    RL_Vector3 *centers = (RL_Vector3 *)RL_MemAlloc(queryCount*sizeof(RL_Vector3));
+    float *radius = (float *)RL_MemAlloc(queryCount*sizeof(float));
+
+    for (int i = 0; i < queryCount; i++)
+    {
+        if (i%2 == 0)
+        {
+            // Picking ray, from above
+            RL_Vector3 from = GenPoint(size, 60.0f, transform);
+            RL_Vector3 to = GenPoint(size, 0.0f, transform);
+            rays[i] = (RL_Ray){ from, Vector3Normalize(Vector3Subtract(to, from)) };
+        }
+        else
+        {
+            // Line-of-sight ray, along the terrain
+            RL_Vector3 from = GenPoint(size, 6.0f, transform);
+            RL_Vector3 to = GenPoint(size, 4.0f, transform);
+            rays[i] = (RL_Ray){ from, Vector3Normalize(Vector3Subtract(to, from)) };
+        }
+
+        RL_Vector3 center = GenPoint(size, RandomFloat()*24.0f - 8.0f, transform);
+        float extent = 0.1f + RandomFloat()*2.0f;
+        boxes[i] = (RL_BoundingBox){ Vector3SubtractValue(center, extent), Vector3AddValue(center, extent) };
+        centers[i] = center;
+        radius[i] = extent;
+    }
+
+    RL_RayCollision *reference = (RL_RayCollision *)RL_MemAlloc(queryCount*sizeof(RL_RayCollision));
+    bool *referenceBoxes = (bool *)RL_MemAlloc(queryCount*sizeof(bool));
+    bool *referenceSpheres = (bool *)RL_MemAlloc(queryCount*sizeof(bool));
+
+    printf("op, accel, triangles, ops_per_s, exact\n");
+
+    // Build and refit
+    //--------------------------------------------------------------------------------------
+    // NOTE: Swapping mesh vertices between two copies forces a full rebuild on every RL_GenMeshBVH() call
+    float *vertices[2] = { mesh.vertices, (float *)RL_MemAlloc(mesh.vertexCount*3*sizeof(float)) };
+    memcpy(vertices[1], vertices[0], mesh.vertexCount*3*sizeof(float));
+
+    for (int op = 0; op < 2; op++)
+    {
+        int runs = 0;
+        double start = GetSeconds();
+        double elapsed = 0.0;
+
+        while (elapsed < runSeconds)
+        {
+            if (op == 0) mesh.vertices = vertices[(runs + 1)%2];
+            else mesh.vertices[1] += 0.001f;
+
+            RL_GenMeshBVH(&mesh);
+            runs++;
+            elapsed = GetSeconds() - start;
+        }
+
+        printf("%s, bvh, %d, %.2f, 1\n", (op == 0)? "build" : "refit", mesh.triangleCount, runs/elapsed);
+        fflush(stdout);
+    }
+
+    // Queries, brute force first (reference), then BVH
+    //--------------------------------------------------------------------------------------
+    const char *names[3] = { "ray", "box", "sphere" };
+
+    for (int op = 0; op < 3; op++)
+    {
+        for (int accel = 0; accel < 2; accel++)
+        {
+            RL_Mesh queryMesh = mesh;
+            if (accel == 0) queryMesh.bvh = NULL;
+
+            bool exact = true;
+            double queries = 0.0;
+            double start = GetSeconds();
+            double elapsed = 0.0;
+
+            do
+            {
+                for (int i = 0; i < queryCount; i++)
+                {
+                    if (op == 0)
+                    {
+                        RL_RayCollision collision = RL_GetRayCollisionMesh(rays[i], queryMesh, transform);
+                        if (accel == 0) reference[i] = collision;
+                        else if (!IsCollisionEqual(collision, reference[i])) exact = false;
+                    }
+                    else if (op == 1)
+                    {
+                        bool collision = RL_CheckCollisionMeshBox(queryMesh, transform, boxes[i]);
+                        if (accel == 0) referenceBoxes[i] = collision;
+                        else if (collision != referenceBoxes[i]) exact = false;
+                    }
+                    else
+                    {
+                        bool collision = RL_CheckCollisionMeshSphere(queryMesh, transform, centers[i], radius[i]);
+                        if (accel == 0) referenceSpheres[i] = collision;
+                        else if (collision != referenceSpheres[i]) exact = false;
+                    }
+                }
+
+                queries += queryCount;
+                elapsed = GetSeconds() - start;
+
+            } while (elapsed < runSeconds);
+
+            printf("%s, %s, %d, %.2f, %d\n", names[op], (accel == 0)? "none" : "bvh", mesh.triangleCount, queries/elapsed, exact? 1 : 0);
+            fflush(stdout);
+        }
+    }
+
+    RL_MemFree(referenceSpheres);
+    RL_MemFree(referenceBoxes);
+    RL_MemFree(reference);
+    RL_MemFree(radius);
+    RL_MemFree(centers);
+    RL_MemFree(boxes);
+    RL_MemFree(rays);
+    RL_MemFree((mesh.vertices == vertices[0])? vertices[1] : vertices[0]);
+    RL_UnloadMesh(mesh);
+
+    return 0;
+}
@@ -0,0 +1,14 @@
+# Run one benchmark, its CSV output is printed and stored on a file
+# Usage: cmake -DBENCH_EXECUTABLE=<benchmark> -DBENCH_OUTPUT=<file.csv> -P run_bench.cmake
+
+get_filename_component(bench_name ${BENCH_EXECUTABLE} NAME_WE)
+message(STATUS "Running ${bench_name}")
+
+execute_process(COMMAND ${BENCH_EXECUTABLE} OUTPUT_FILE ${BENCH_OUTPUT} RESULT_VARIABLE bench_result)
+
+if(NOT bench_result EQUAL 0)
+    message(FATAL_ERROR "${bench_name} failed: ${bench_result}")
+endif()
+
+file(READ ${BENCH_OUTPUT} bench_csv)
+message("${bench_csv}")
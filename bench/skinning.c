@@ -0,0 +1,287 @@
+/*******************************************************************************************
+*
+*   CPU skinning benchmark (no window required)
+*
+*   Animates a crowd of characters sharing one skeleton and a few animation frames, and
+*   prints one CSV line per run:
+*
+*       mode, simd, threads, normals, characters, vertices, unique_poses, mverts_per_s
+*
+*   Modes:
+*       reference: previous per-vertex RL_UpdateModelAnimation() code, kept here for comparison
+*       single: one RL_UpdateModelAnimation() call per character
+*       batched: one RL_UpdateModelAnimations() call for the whole crowd
+*
+*   Usage: skinning [characters] [vertices per character] [unique poses] [seconds per run]
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BONE_COUNT          64
+#define FRAME_COUNT         32
+
+static unsigned int seed = 0x12345678;
+
+static float RandomFloat(void)
+{
+    seed = seed*1664525u + 1013904223u;
+    return (float)(seed >> 8)/16777216.0f;
+}
+
+static double GetSeconds(void)
+{
+    struct timespec ts = { 0 };
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+static RL_Transform GenTransform(void)
+{
+    RL_Transform transform = { 0 };
+
+    transform.translation = (RL_Vector3){ RandomFloat()*2.0f - 1.0f, RandomFloat()*2.0f - 1.0f, RandomFloat()*2.0f - 1.0f };
+    transform.rotation = QuaternionNormalize((RL_Quaternion){ RandomFloat() - 0.5f, RandomFloat() - 0.5f, RandomFloat() - 0.5f, RandomFloat() - 0.5f });
+    transform.scale = (RL_Vector3){ 1.0f, 1.0f, 1.0f };
+
+    return transform;
+}
+
+// Generate character model with one skinned mesh, CPU data only (not uploaded to GPU)
+static RL_Model GenCharacter(int vertexCount)
+{
+    RL_Model model = { 0 };
+
+    model.transform = MatrixIdentity();
+    model.meshCount = 1;
+    model.meshes = (RL_Mesh *)RL_MemAlloc(sizeof(RL_Mesh));
+    model.boneCount = BONE_COUNT;
+    model.bones = (RL_BoneInfo *)RL_MemAlloc(BONE_COUNT*sizeof(RL_BoneInfo));
+    model.bindPose = (RL_Transform *)RL_MemAlloc(BONE_COUNT*sizeof(RL_Transform));
+
+    for (int i = 0; i < BONE_COUNT; i++) model.bindPose[i] = GenTransform();
+
+    RL_Mesh *mesh = &model.meshes[0];
+    mesh->vertexCount = vertexCount;
+    mesh->vertices = (float *)RL_MemAlloc(vertexCount*3*sizeof(float));
+    mesh->normals = (float *)RL_MemAlloc(vertexCount*3*sizeof(float));
+    mesh->animVertices = (float *)RL_MemAlloc(vertexCount*3*sizeof(float));
+    mesh->animNormals = (float *)RL_MemAlloc(vertexCount*3*sizeof(float));
+    mesh->boneIds = (unsigned char *)RL_MemAlloc(vertexCount*4);
+    mesh->boneWeights = (float *)RL_MemAlloc(vertexCount*4*sizeof(float));
+
+    for (int i = 0; i < vertexCount*3; i++)
+    {
+        mesh->vertices[i] = RandomFloat()*2.0f - 1.0f;
+        mesh->normals[i] = RandomFloat()*2.0f - 1.0f;
+    }
+
+    // Vertices influenced by 1 to 4 bones, neighbour vertices (same body part) use the same number of bones
+    for (int i = 0; i < vertexCount; i++)
+    {
+        int influences = 1 + (i/64)%4;
+        float total = 0.0f;
+
+        for (int j = 0; j < 4; j++)
+        {
+            mesh->boneIds[i*4 + j] = (unsigned char)(RandomFloat()*BONE_COUNT);
+            mesh->boneWeights[i*4 + j] = (j < influences)? RandomFloat() + 0.01f : 0.0f;
+            total += mesh->boneWeights[i*4 + j];
+        }
+
+        for (int j = 0; j < 4; j++) mesh->boneWeights[i*4 + j] /= total;
+    }
+
+    return model;
+}
+
+// Generate character instance, sharing bind pose and vertex data with base character
+static RL_Model GenCharacterInstance(RL_Model base)
+{
+    RL_Model model = base;
+    int vertexCount = base.meshes[0].vertexCount;
+
+    model.meshes = (RL_Mesh *)RL_MemAlloc(sizeof(RL_Mesh));
+    model.meshes[0] = base.meshes[0];
+    model.meshes[0].animVertices = (float *)RL_MemAlloc(vertexCount*3*sizeof(float));
+    model.meshes[0].animNormals = (float *)RL_MemAlloc(vertexCount*3*sizeof(float));
+    model.meshes[0].skinData = NULL;
+
+    return model;
+}
+
+static RL_ModelAnimation GenAnimation(void)
+{
+    RL_ModelAnimation anim = { 0 };
+
+    anim.boneCount = BONE_COUNT;
+    anim.frameCount = FRAME_COUNT;
+    anim.bones = (RL_BoneInfo *)RL_MemAlloc(BONE_COUNT*sizeof(RL_BoneInfo));
+    anim.framePoses = (RL_Transform **)RL_MemAlloc(FRAME_COUNT*sizeof(RL_Transform *));
+
+    for (int frame = 0; frame < FRAME_COUNT; frame++)
+    {
+        anim.framePoses[frame] = (RL_Transform *)RL_MemAlloc(BONE_COUNT*sizeof(RL_Transform));
+        for (int i = 0; i < BONE_COUNT; i++) anim.framePoses[frame][i] = GenTransform();
+    }
+
+    return anim;
+}
+
+// Previous RL_UpdateModelAnimation() skinning code (without GPU upload)
+static void UpdateModelAnimationReference(RL_Model model, RL_ModelAnimation anim, int frame)
+{
+    if (frame >= anim.frameCount) frame = frame%anim.frameCount;
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        RL_Mesh mesh = model.meshes[m];
+        int boneCounter = 0;
+
+        for (int vCounter = 0; vCounter < mesh.vertexCount*3; vCounter += 3)
+        {
+            mesh.animVertices[vCounter] = 0;
+            mesh.animVertices[vCounter + 1] = 0;
+            mesh.animVertices[vCounter + 2] = 0;
+            mesh.animNormals[vCounter] = 0;
+            mesh.animNormals[vCounter + 1] = 0;
+            mesh.animNormals[vCounter + 2] = 0;
+
+            for (int j = 0; j < 4; j++, boneCounter++)
+            {
+                float boneWeight = mesh.boneWeights[boneCounter];
+                if (boneWeight == 0.0f) continue;
+
+                int boneId = mesh.boneIds[boneCounter];
+                RL_Transform in = model.bindPose[boneId];
+                RL_Transform out = anim.framePoses[frame][boneId];
+                RL_Quaternion rotation = QuaternionMultiply(out.rotation, QuaternionInvert(in.rotation));
+
+                RL_Vector3 animVertex = { mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
+                animVertex = Vector3Add(Vector3RotateByQuaternion(Vector3Multiply(Vector3Subtract(animVertex, in.translation), out.scale), rotation), out.translation);
+                mesh.animVertices[vCounter] += animVertex.x*boneWeight;
+                mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
+                mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
+
+                RL_Vector3 animNormal = { mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
+                animNormal = Vector3RotateByQuaternion(animNormal, rotation);
+                mesh.animNormals[vCounter] += animNormal.x*boneWeight;
+                mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
+                mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
+            }
+        }
+    }
+}
+
+typedef enum { MODE_REFERENCE = 0, MODE_SINGLE, MODE_BATCHED } BenchMode;
+
+static void RunFrame(BenchMode mode, RL_ModelAnimationJob *jobs, int jobCount, bool normals)
+{
+    switch (mode)
+    {
+        case MODE_REFERENCE: for (int i = 0; i < jobCount; i++) UpdateModelAnimationReference(jobs[i].model, jobs[i].anim, jobs[i].frame); break;
+        case MODE_SINGLE: for (int i = 0; i < jobCount; i++) RL_UpdateModelAnimation(jobs[i].model, jobs[i].anim, jobs[i].frame); break;
+        case MODE_BATCHED: RL_UpdateModelAnimations(jobs, jobCount, normals); break;
+        default: break;
+    }
+}
+
+static void RunBench(BenchMode mode, int simd, int threads, bool normals, RL_ModelAnimationJob *jobs, int jobCount, int uniquePoses, double runSeconds)
+{
+    const char *modeNames[] = { "reference", "single", "batched" };
+    int vertexCount = jobs[0].model.meshes[0].vertexCount;
+
+    RL_SetSimdLevel(simd);
+    RL_SetWorkerThreadCount(threads);
+
+    RunFrame(mode, jobs, jobCount, normals);     // Warm up, skinning data is built on first update
+
+    int frames = 0;
+    double start = GetSeconds();
+    double elapsed = 0.0;
+
+    while (elapsed < runSeconds)
+    {
+        // Advance animation, poses stay shared by the same characters
+        for (int i = 0; i < jobCount; i++) jobs[i].frame = (jobs[i].frame + uniquePoses)%FRAME_COUNT;
+
+        RunFrame(mode, jobs, jobCount, normals);
+        frames++;
+        elapsed = GetSeconds() - start;
+    }
+
+    printf("%s, %d, %d, %d, %d, %d, %d, %.2f\n", modeNames[mode], (mode == MODE_REFERENCE)? 0 : simd, (mode == MODE_REFERENCE)? 1 : threads,
+        normals? 1 : 0, jobCount, vertexCount, uniquePoses, (double)frames*jobCount*vertexCount/elapsed*1e-6);
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    int characterCount = (argc > 1)? atoi(argv[1]) : 200;
+    int vertexCount = (argc > 2)? atoi(argv[2]) : 4000;
+    int uniquePoses = (argc > 3)? atoi(argv[3]) : 8;
+    double runSeconds = (argc > 4)? atof(argv[4]) : 1.0;
+
+    if (uniquePoses < 1) uniquePoses = 1;
+    if (uniquePoses > FRAME_COUNT) uniquePoses = FRAME_COUNT;
+
+    RL_SetTraceLogLevel(LOG_WARNING);
+
+    RL_SetSimdLevel(SIMD_LEVEL_AVX2);
+    int maxSimdLevel = RL_GetSimdLevel();
+    RL_SetWorkerThreadCount(0);
+    int maxThreads = RL_GetWorkerThreadCount();
+
+    RL_Model base = GenCharacter(vertexCount);
+    RL_ModelAnimation anim = GenAnimation();
+    RL_ModelAnimationJob *jobs = (RL_ModelAnimationJob *)RL_MemAlloc(characterCount*sizeof(RL_ModelAnimationJob));
+
+    for (int i = 0; i < characterCount; i++)
+    {
+        jobs[i].model = GenCharacterInstance(base);
+        jobs[i].anim = anim;
+        jobs[i].frame = i%uniquePoses;
+    }
+
+    printf("mode, simd, threads, normals, characters, vertices, unique_poses, mverts_per_s\n");
+
+    RunBench(MODE_REFERENCE, SIMD_LEVEL_NONE, 1, true, jobs, characterCount, uniquePoses, runSeconds);
+    RunBench(MODE_SINGLE, maxSimdLevel, maxThreads, true, jobs, characterCount, uniquePoses, runSeconds);
+
+    for (int simd = SIMD_LEVEL_NONE; simd <= maxSimdLevel; simd++)
+    {
+        for (int t = 0; t < ((maxThreads > 1)? 2 : 1); t++)
+        {
+            int threads = (t == 0)? 1 : maxThreads;
+
+            RunBench(MODE_BATCHED, simd, threads, true, jobs, characterCount, uniquePoses, runSeconds);
+            RunBench(MODE_BATCHED, simd, threads, false, jobs, characterCount, uniquePoses, runSeconds);
+        }
+    }
+
+    for (int i = 0; i < characterCount; i++)
+    {
+        // Shared data belongs to base character, only instance data is unloaded
+        RL_Mesh mesh = jobs[i].model.meshes[0];
+        RL_Mesh instance = { 0 };
+        instance.animVertices = mesh.animVertices;
+        instance.animNormals = mesh.animNormals;
+        instance.skinData = mesh.skinData;
+        RL_UnloadMesh(instance);
+        RL_MemFree(jobs[i].model.meshes);
+    }
+
+    RL_MemFree(jobs);
+    RL_UnloadModelAnimation(anim);
+    RL_UnloadModel(base);
+
+    RL_SetWorkerThreadCount(1);     // Stops worker threads
+
+    return 0;
+}
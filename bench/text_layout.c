@@ -0,0 +1,205 @@
+/*******************************************************************************************
+*
+*   Text layout benchmark (CPU only, no window required)
+*
+*   Loads a generated image font (XNA style), then measures texts with RL_MeasureTextEx() with
+*   the text layout cache disabled and enabled, and prints one CSV line per run:
+*
+*       op, cache, texts, bytes, texts_per_s, mb_per_s, exact
+*
+*   Ops:
+*       labels: short UI labels, the same ones measured every frame
+*       paragraphs: long multiline texts
+*       utf8: labels with 2 and 3 bytes codepoints, most of them missing on font (fallback glyph)
+*       unique: formatted texts changing every frame, more texts than cache entries (cache misses)
+*
+*   exact tells if every measured size matches the one measured without cache.
+*
+*   Usage: text_layout [cache entries] [seconds per run]
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FONT_FIRST_CHAR     32
+#define FONT_GLYPHS         95          // Printable ASCII characters
+#define FONT_HEIGHT         16
+#define FONT_SIZE           20.0f
+#define FONT_SPACING        1.0f
+
+typedef struct {
+    const char *name;
+    int count;          // Number of texts
+    int minLength;      // Text length range in bytes (approximate for utf8)
+    int maxLength;
+    bool multiline;
+    bool utf8;
+} BenchCase;
+
+static const BenchCase cases[] = {
+    { "labels", 64, 6, 24, false, false },
+    { "paragraphs", 16, 400, 800, true, false },
+    { "utf8", 64, 6, 24, false, true },
+    { "unique", 4096, 12, 20, false, false }
+};
+
+static unsigned int seed = 0x12345678;
+
+static unsigned int Random(void)
+{
+    seed = seed*1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+static double GetSeconds(void)
+{
+    struct timespec ts = { 0 };
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+// Generate image font (XNA style), glyphs of random widths separated by key color, 1 pixel spacing
+static RL_Font GenFont(void)
+{
+    const int width = 256;
+    int widths[FONT_GLYPHS] = { 0 };
+    int rows = 1;
+    int x = 1;
+
+    for (int i = 0; i < FONT_GLYPHS; i++)
+    {
+        widths[i] = 4 + (int)(Random()%9);
+        if ((x + widths[i] + 1) > width) { rows++; x = 1; }
+        x += widths[i] + 1;
+    }
+
+    RL_Image image = RL_GenImageColor(width, 1 + rows*(FONT_HEIGHT + 1), RL_MAGENTA);
+
+    x = 1;
+    int y = 1;
+
+    for (int i = 0; i < FONT_GLYPHS; i++)
+    {
+        if ((x + widths[i] + 1) > width) { y += FONT_HEIGHT + 1; x = 1; }
+        RL_ImageDrawRectangle(&image, x, y, widths[i], FONT_HEIGHT, RL_WHITE);
+        x += widths[i] + 1;
+    }
+
+    RL_Font font = RL_LoadFontFromImage(image, RL_MAGENTA, FONT_FIRST_CHAR);
+    RL_UnloadImage(image);
+
+    return font;
+}
+
+// Generate text, random words, NOTE: unique texts are formatted as a frame counter would be
+static char *GenText(const BenchCase *test, int index)
+{
+    static const char *codepoints[] = { "\xc3\xa9", "\xc3\xb1", "\xc3\xbc", "\xe2\x82\xac", "\xe2\x80\x94", "\xe3\x81\x82" };
+
+    int length = test->minLength + (int)(Random()%(test->maxLength - test->minLength + 1));
+    char *text = (char *)RL_MemAlloc(length + 4);
+    int size = 0;
+
+    if (strcmp(test->name, "unique") == 0) size = snprintf(text, length + 4, "Score: %i", index*7919);
+
+    while (size < length)
+    {
+        if (test->multiline && (size > 0) && (Random()%48 == 0)) text[size++] = '\n';
+        else if ((size > 0) && (Random()%6 == 0)) text[size++] = ' ';
+        else if (test->utf8 && (Random()%4 == 0))
+        {
+            const char *codepoint = codepoints[Random()%(sizeof(codepoints)/sizeof(codepoints[0]))];
+            int codepointSize = (int)strlen(codepoint);
+
+            if ((size + codepointSize) > length) break;
+
+            memcpy(text + size, codepoint, codepointSize);
+            size += codepointSize;
+        }
+        else text[size++] = (char)(FONT_FIRST_CHAR + 1 + Random()%(FONT_GLYPHS - 1));
+    }
+
+    text[size] = '\0';
+
+    return text;
+}
+
+int main(int argc, char *argv[])
+{
+    int cacheEntries = (argc > 1)? atoi(argv[1]) : 256;
+    double runSeconds = (argc > 2)? atof(argv[2]) : 0.5;
+
+    if (cacheEntries < 1) cacheEntries = 1;
+
+    RL_SetTraceLogLevel(LOG_ERROR);
+
+    RL_Font font = GenFont();
+
+    if (font.glyphCount != FONT_GLYPHS)
+    {
+        printf("Generated font could not be loaded\n");
+        return 1;
+    }
+
+    printf("op, cache, texts, bytes, texts_per_s, mb_per_s, exact\n");
+
+    for (int c = 0; c < (int)(sizeof(cases)/sizeof(cases[0])); c++)
+    {
+        const BenchCase *test = &cases[c];
+
+        char **texts = (char **)RL_MemAlloc(test->count*sizeof(char *));
+        RL_Vector2 *reference = (RL_Vector2 *)RL_MemAlloc(test->count*sizeof(RL_Vector2));
+        double bytes = 0.0;
+
+        for (int i = 0; i < test->count; i++)
+        {
+            texts[i] = GenText(test, i);
+            bytes += (double)strlen(texts[i]);
+        }
+
+        // NOTE: First run is not cached, its sizes are the reference ones
+        for (int cache = 0; cache < 2; cache++)
+        {
+            RL_SetTextLayoutCacheSize((cache == 0)? 0 : cacheEntries);
+
+            bool exact = true;
+            double measured = 0.0;
+            double start = GetSeconds();
+            double elapsed = 0.0;
+
+            do
+            {
+                for (int i = 0; i < test->count; i++)
+                {
+                    RL_Vector2 size = RL_MeasureTextEx(font, texts[i], FONT_SIZE, FONT_SPACING);
+
+                    if (cache == 0) reference[i] = size;
+                    else if ((size.x != reference[i].x) || (size.y != reference[i].y)) exact = false;
+                }
+
+                measured += 1.0;
+                elapsed = GetSeconds() - start;
+
+            } while (elapsed < runSeconds);
+
+            printf("%s, %d, %d, %.0f, %.1f, %.1f, %d\n", test->name, (cache == 0)? 0 : cacheEntries, test->count, bytes,
+                measured*test->count/elapsed, measured*bytes/1e6/elapsed, exact? 1 : 0);
+            fflush(stdout);
+        }
+
+        RL_SetTextLayoutCacheSize(0);
+
+        for (int i = 0; i < test->count; i++) RL_MemFree(texts[i]);
+        RL_MemFree(reference);
+        RL_MemFree(texts);
+    }
+
+    RL_UnloadFont(font);
+
+    return 0;
+}
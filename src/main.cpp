@@ -8,6 +8,7 @@
 #include "SDL3/SDL_init.h"
 #include "SDL3/SDL_keycode.h"
 #include "SDL3/SDL_video.h"
+#include "profile.h"
 
 uint32_t width = 1024;
 uint32_t height = 800;
@@ -26,31 +27,43 @@ int main() {
         return -1;
     }
 
+    PROFILE_THREAD_NAME( "Main" );
+
     bool run = true;
     SDL_Event event = {};
     while ( run ) {
-        while ( SDL_PollEvent( &event ) ) {
-            switch ( event.type ) {
-                case SDL_EVENT_QUIT:
-                    run = false;
-                    break;
-                case SDL_EVENT_KEY_DOWN:
-                    if ( event.key.key == SDLK_ESCAPE ) {
+        {
+            PROFILE_ZONE( "PollEvents" );
+            while ( SDL_PollEvent( &event ) ) {
+                switch ( event.type ) {
+                    case SDL_EVENT_QUIT:
                         run = false;
-                    }
-                    break;
+                        break;
+                    case SDL_EVENT_KEY_DOWN:
+                        if ( event.key.key == SDLK_ESCAPE ) {
+                            run = false;
+                        }
+                        break;
+                }
             }
         }
+
+        PROFILE_FRAME();
     }
 
-    SDL_GPUCommandBuffer* commandBuffer =
-        SDL_AcquireGPUCommandBuffer( gpu );
+    {
+        PROFILE_ZONE( "Present" );
+        SDL_GPUCommandBuffer* commandBuffer =
+            SDL_AcquireGPUCommandBuffer( gpu );
 
-    SDL_GPUTexture* swapchain = nullptr;
-    SDL_WaitAndAcquireGPUSwapchainTexture(
-        commandBuffer, window, &swapchain, &width, &height );
+        SDL_GPUTexture* swapchain = nullptr;
+        SDL_WaitAndAcquireGPUSwapchainTexture(
+            commandBuffer, window, &swapchain, &width, &height );
+
+        assert( SDL_SubmitGPUCommandBuffer( commandBuffer ) );
+    }
 
-    assert( SDL_SubmitGPUCommandBuffer( commandBuffer ) );
+    PROFILE_EXPORT( "profile_trace.json" );
 
     SDL_Quit();
     return 0;
@@ -0,0 +1,29 @@
+#pragma once
+
+// Scoped profile zones, recorded by raylib profiler when built with PROFILER option
+// (SUPPORT_PROFILER), compiled out otherwise.
+#if defined( SUPPORT_PROFILER )
+#include "raylib.h"
+
+struct ProfileZone {
+    explicit ProfileZone( const char* name ) { RL_BeginProfileZone( name ); }
+    ~ProfileZone() { RL_EndProfileZone(); }
+
+    ProfileZone( const ProfileZone& ) = delete;
+    ProfileZone& operator=( const ProfileZone& ) = delete;
+};
+
+#define PROFILE_CONCAT_( a, b ) a##b
+#define PROFILE_CONCAT( a, b ) PROFILE_CONCAT_( a, b )
+
+// NOTE: name must be a static string, zones keep the pointer
+#define PROFILE_ZONE( name ) ProfileZone PROFILE_CONCAT( profileZone, __LINE__ )( name )
+#define PROFILE_FRAME() RL_EndProfileFrame()
+#define PROFILE_THREAD_NAME( name ) RL_SetProfileThreadName( name )
+#define PROFILE_EXPORT( fileName ) RL_ExportProfileTrace( fileName )
+#else
+#define PROFILE_ZONE( name ) ( (void)0 )
+#define PROFILE_FRAME() ( (void)0 )
+#define PROFILE_THREAD_NAME( name ) ( (void)0 )
+#define PROFILE_EXPORT( fileName ) ( (void)0 )
+#endif
@@ -0,0 +1,73 @@
+/*******************************************************************************************
+*
+*   Pack files tool
+*
+*   Exports every file of a directory, subdirectories included, to a pack file. Entries paths are
+*   relative to the directory, mount the pack file on it to load them with RL_LoadPackFileData():
+*
+*       RL_MountPack("assets.rpak", "resources");
+*       RL_SetLoadFileDataCallback(RL_LoadPackFileData);
+*       RL_SetLoadFileTextCallback(RL_LoadPackFileText);
+*
+*   Entries data is aligned to alignment bytes (power of two, default 16), --lz4 compresses
+*   entries that shrink by 1/8 or more (already compressed formats are kept as they are).
+*
+*   Usage: pack <directory> <pack file> [alignment] [--lz4]
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main(int argc, char *argv[])
+{
+    const char *directory = NULL;
+    const char *fileName = NULL;
+    int alignment = 16;
+    bool compress = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--lz4") == 0) compress = true;
+        else if (directory == NULL) directory = argv[i];
+        else if (fileName == NULL) fileName = argv[i];
+        else alignment = atoi(argv[i]);
+    }
+
+    if ((directory == NULL) || (fileName == NULL))
+    {
+        printf("Usage: pack <directory> <pack file> [alignment] [--lz4]\n");
+        return 1;
+    }
+
+    if ((alignment <= 0) || ((alignment & (alignment - 1)) != 0))
+    {
+        printf("Alignment must be a power of two\n");
+        return 1;
+    }
+
+    if (!RL_DirectoryExists(directory))
+    {
+        printf("Directory not found: %s\n", directory);
+        return 1;
+    }
+
+    RL_SetTraceLogLevel(LOG_WARNING);
+
+    RL_FilePathList files = RL_LoadDirectoryFilesEx(directory, NULL, true);
+
+    double filesSize = 0.0;
+    for (unsigned int i = 0; i < files.count; i++) filesSize += RL_GetFileLength(files.paths[i]);
+
+    bool success = RL_ExportPack(files, directory, fileName, alignment, compress);
+
+    if (success) printf("%s: %u files, %.2f MB -> %.2f MB\n", fileName, files.count, filesSize/1e6, RL_GetFileLength(fileName)/1e6);
+    else printf("Failed to export pack file: %s\n", fileName);
+
+    RL_UnloadDirectoryFiles(files);
+
+    return success? 0 : 1;
+}